@@ -92,5 +92,8 @@ f.close()
 #######  Start of main SConscript ###########
 
 analyzer = baseenv.Program(target = 'analyzer', source = 'src/main.o')
+formbench = baseenv.Program(target = 'formbench', source = 'src/formbench_main.o')
+varbench = baseenv.Program(target = 'varbench', source = 'src/varbench_main.o')
+vhistbench = baseenv.Program(target = 'vhistbench', source = 'src/vhistbench_main.o')
 baseenv.Install('./bin',analyzer)
 baseenv.Alias('install',['./bin'])
@@ -41,11 +41,13 @@ class CodaDecoder : public THaEvData {
   Bool_t  buffmode,synchmiss,synchextra;
 
   Int_t *fbfound;
+  Int_t  fNSlotDecode[MAXROC];  // Number of slots to decode per ROC
 
   void CompareRocs();
   void ChkFbSlot( Int_t roc, const UInt_t* evbuffer, Int_t ipt, Int_t istop );
   void ChkFbSlots();
   void FindUsedSlots();
+  void SetupRequests();
 
   int init_slotdata(const THaCrateMap *map);
   void dump(const UInt_t* evbuffer) const;
@@ -6,6 +6,12 @@
 //   F1TDCModule
 //   JLab F1 TDC Module
 //
+//   If a reference channel is configured, the times loaded into the
+//   slot data are corrected at decode time: the reference time is
+//   subtracted from all hits of the slot and the result is unwrapped
+//   around the TDC rollover. The raw words remain available as the
+//   raw data of each hit.
+//
 /////////////////////////////////////////////////////////////////////
 
 #include "VmeModule.h"
@@ -16,7 +22,8 @@ class F1TDCModule : public VmeModule {
 
 public:
 
-   F1TDCModule() {};
+   F1TDCModule() : fTdcData(0), fTdcRaw(0), fNumHitsChan(0), fHitChan(0),
+     fHitRaw(0), fHitTime(0) {};
    F1TDCModule(Int_t crate, Int_t slot);
    virtual ~F1TDCModule();
 
@@ -25,8 +32,11 @@ public:
    enum EResolution { ILO = 0, IHI = 1 };
 
    virtual void Init();
+   virtual void Configure(const char* cfg);
    virtual Bool_t IsSlot(UInt_t rdata);
    virtual Int_t GetData(Int_t chan, Int_t hit) const;
+   Int_t GetRawData(Int_t chan, Int_t hit) const;
+   Int_t GetNumHits(Int_t chan) const;
 
    void SetResolution(Int_t which=0) {
      fResol = IHI;
@@ -38,6 +48,20 @@ public:
 
    Int_t GetNumHits() const { return fNumHits; };
 
+   // Reference time correction. chan < 0 disables it. The rollover is
+   // the period of the TDC counter; 0 disables the unwrapping.
+   Int_t SetReferenceChannel(Int_t chan);
+   void SetRollover(Int_t rollover) { fRollover = rollover; }
+   Int_t GetReferenceChannel() const { return fRefChan; }
+   Int_t GetRollover() const { return fRollover; }
+   // False if a reference channel is set but had no hit in this event.
+   // Times are then left uncorrected.
+   Bool_t IsRefTimeValid() const { return fRefValid; }
+   Int_t GetRefTime() const { return fRefTime; }
+
+   static void CorrectTimes(const Int_t* raw, Int_t* corr, Int_t n,
+			    Int_t reftime, Int_t rollover);
+
 private:
 
 // Loads sldat and increments ptr to evbuffer
@@ -45,7 +69,14 @@ private:
 
    Int_t fNumHits;
    EResolution fResol;
-   Int_t *fTdcData;  // Raw data (either samples or pulse integrals)
+   Int_t *fTdcData;  // Hit times, corrected if a reference is set
+   Int_t *fTdcRaw;   // Raw hit times
+   Int_t *fNumHitsChan; // Hits per channel
+   Int_t *fHitChan, *fHitRaw, *fHitTime;  // All hits in readout order
+   Int_t fRefChan;   // Reference channel (hana numbering), -1 = none
+   Int_t fRollover;  // TDC counter period, 0 = no unwrapping
+   Int_t fRefTime;   // Reference time of the current event
+   Bool_t fRefValid; // Reference time found in this event
    Bool_t IsInit;
    void Clear(const Option_t *opt);
    static TypeIter_t fgThisType;
@@ -16,7 +16,8 @@ class Fadc250Module : public VmeModule {
 
 public:
 
-   Fadc250Module() {};
+   Fadc250Module() : fNumAInt(0), fNumTInt(0), fNumSample(0), fAdcData(0),
+     fTdcData(0), fNumPulse(0), fPedestal(0), fPulse(0) {};
    Fadc250Module(Int_t crate, Int_t slot);
    virtual ~Fadc250Module();
 
@@ -40,6 +41,40 @@ public:
    Bool_t IsSampleMode() const { return (f250_setmode == F250_SAMPLE); };
    Bool_t IsIntegMode() const { return (f250_setmode == F250_INTEG); };
 
+   // Pulse analysis of sample-mode data.  The algorithm follows the FPGA
+   // integrated mode (pulse integral and pulse time words, types 7 and 8),
+   // so both modes give the same integral and time for the same pulse.
+   enum { MAXPULSE = 4 };            // pulses per window, as in the FPGA
+   struct PulseParams_t {
+     Int_t fNSB;        // Samples before threshold crossing in integral
+     Int_t fNSA;        // Samples from threshold crossing on in integral
+     Int_t fTET;        // Threshold (raw ADC counts)
+     Int_t fNPED;       // Leading samples averaged for the pedestal
+     Int_t fNPulseMax;  // Max pulses to find per window (<= MAXPULSE)
+   };
+   struct PulseResult_t {
+     Int_t fPeak;       // Maximum sample above threshold
+     Int_t fIntegral;   // Sum of samples in [tc-NSB,tc+NSA)
+     Int_t fTOT;        // Number of samples above threshold
+     Int_t fTime;       // Leading edge at half height, 1/64 sample units
+   };
+
+   virtual void Configure(const char* cfg);
+   void SetPulseParams(const PulseParams_t& par) { fPulsePar = par; }
+   const PulseParams_t& GetPulseParams() const { return fPulsePar; }
+   void EnablePulseAnalysis(Bool_t enable=kTRUE) { fDoPulseAna = enable; }
+   Bool_t PulseAnalysisEnabled() const { return fDoPulseAna; }
+
+   Int_t    GetNumPulses(Int_t chan) const;
+   Double_t GetPedestal(Int_t chan) const;
+   const PulseResult_t* GetPulse(Int_t chan, Int_t ipulse) const;
+
+   // Analyze one window of samples; returns the number of pulses found.
+   // 'result' must have room for MAXPULSE entries.
+   static Int_t AnalyzePulses( const Int_t* samples, Int_t nsamples,
+			       const PulseParams_t& par, Double_t& pedestal,
+			       PulseResult_t* result, Bool_t use_simd=kTRUE );
+
 private:
 
    enum { F250_SAMPLE = 1, F250_INTEG = 2 };  // supported modes
@@ -97,6 +132,12 @@ private:
    Int_t fNumTrig, fNumEvents, *fNumAInt, *fNumTInt,  *fNumSample;
    Int_t *fAdcData;  // Raw data (either samples or pulse integrals)
    Int_t *fTdcData;
+   Bool_t fDoPulseAna;          // Run pulse analysis on sample-mode data
+   PulseParams_t fPulsePar;     // Pulse analysis parameters
+   Int_t *fNumPulse;            // [NADCCHAN] pulses found per channel
+   Double_t *fPedestal;         // [NADCCHAN] pedestal per channel
+   PulseResult_t *fPulse;       // [NADCCHAN*MAXPULSE] pulse results
+   void AnalyzeSamples();
    Bool_t IsInit;
    void Clear(const Option_t *opt);
    void CheckSetMode() const;
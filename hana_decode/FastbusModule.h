@@ -17,7 +17,7 @@ class FastbusModule : public Module {
 
 public:
 
-   FastbusModule() { fDebugFile=0; };
+   FastbusModule() : fTableDecode(kFALSE) { fDebugFile=0; };
    FastbusModule(Int_t crate, Int_t slot);
    virtual ~FastbusModule();
 
@@ -30,6 +30,22 @@ public:
    Int_t Chan(UInt_t rdata) { return (rdata&fChanMask)>>fChanShift; };
    Int_t Data(UInt_t rdata) { return (rdata&fDataMask); };
 
+   // Layout of the data words of a FASTBUS model
+   struct FieldDesc_t {
+     Int_t  fModel;
+     UInt_t fChanMask;  Int_t fChanShift;
+     UInt_t fDataMask;
+     UInt_t fWdcntMask;
+     UInt_t fOptMask;   Int_t fOptShift;
+     Bool_t fHasHeader;
+   };
+   static const FieldDesc_t* GetFieldDesc(Int_t model);
+
+   // Decode a slot's word block in one pass using the model's field
+   // layout (default for models in the table) or word by word via Decode()
+   void SetTableDecode(Bool_t enable=kTRUE) { fTableDecode = enable; }
+   Bool_t IsTableDecode() const { return fTableDecode; }
+
 protected:
 
    Bool_t fHasHeader;
@@ -38,7 +54,11 @@ protected:
    Int_t fDataMask;
    Int_t fOptMask, fOptShift;
    Int_t fChan, fData, fRawData;
+   Bool_t fTableDecode;
    virtual void Init();
+   Bool_t SetFields(Int_t model);
+   Int_t LoadSlotByWord(THaSlotData *sldat, const UInt_t* evbuffer, const UInt_t *pstop);
+   Int_t LoadSlotTable(THaSlotData *sldat, const UInt_t* evbuffer, const UInt_t *pstop);
 
 
 private:
@@ -67,6 +67,9 @@ namespace Decoder {
 
     virtual void Init();
 
+    // Apply the "key=value ..." configuration string from the crate map
+    virtual void Configure(const char*) {}
+
     virtual void Clear(const Option_t *opt) { fWordsSeen = 0; };
 
     virtual Bool_t IsSlot(UInt_t rdata);
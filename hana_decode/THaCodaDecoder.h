@@ -31,6 +31,11 @@ class THaCodaDecoder : public THaEvData {
   virtual Double_t GetEpicsData(const char* tag, Int_t event=0) const;
   virtual Double_t GetEpicsTime(const char* tag, Int_t event=0) const;
   virtual TString GetEpicsString(const char* tag, Int_t event=0) const;
+  virtual Int_t GetEpicsTagID(const char* tag);
+  virtual Bool_t IsLoadedEpics(Int_t id) const;
+  virtual Double_t GetEpicsData(Int_t id, Int_t event=0) const;
+  virtual Double_t GetEpicsTime(Int_t id, Int_t event=0) const;
+  virtual TString GetEpicsString(Int_t id, Int_t event=0) const;
 
   virtual void PrintOut() const { dump(buffer); }
   virtual void SetRunTime(ULong64_t tloc);
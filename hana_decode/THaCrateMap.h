@@ -22,6 +22,8 @@
 #include "Decoder.h"
 #include <fstream>
 #include <cassert>
+#include <map>
+#include <vector>
 
 namespace Decoder {
 
@@ -48,6 +50,7 @@ class THaCrateMap {
      int getHeader(int crate, int slot) const;      // Return header
      int getMask(int crate, int slot) const;        // Return header mask
      int getScalerCrate(int word) const;            // Return scaler crate if word=header
+     const char* getConfig(int crate, int slot) const; // Module configuration string
      const char* getScalerLoc(int crate) const;     // Return scaler crate location
      int setCrateType(int crate, const char* type); // set the crate type
      int setModel(int crate, int slot, UShort_t mod,
@@ -55,6 +58,7 @@ class THaCrateMap {
 		  UShort_t ndata=MAXDATA);          // set the module type
      int setHeader(int crate, int slot, int head);  // set the header
      int setMask(int crate, int slot, int mask);    // set the header mask
+     int setConfig(int crate, int slot, const char* cfg); // set module configuration
      int setScalerLoc(int crate, const char* location); // Sets the scaler location
      UShort_t getNchan(int crate, int slot) const;  // Max number of channels
      UShort_t getNdata(int crate, int slot) const;  // Max number of data words
@@ -67,6 +71,7 @@ class THaCrateMap {
      void setUnused(int crate,int slot);            // Disables this crate,slot
      int init(TString the_map);                     // Initialize from text-block
      int init(ULong64_t time = 0);                  // Initialize by Unix time.
+     static void ClearCache();                      // Forget parsed crate maps
      void print() const;
      void print(std::ofstream *file) const;
 
@@ -89,9 +94,23 @@ class THaCrateMap {
        UShort_t model[MAXSLOT];
        Int_t header[MAXSLOT], headmask[MAXSLOT];
        UShort_t nchan[MAXSLOT], ndata[MAXSLOT];
+       TString config[MAXSLOT];
        TString scalerloc;
      } crdat[MAXROC];
      bool didslot[MAXSLOT];
+
+#ifndef __CINT__
+     // Parsed crate maps, shared by all instances. The key identifies
+     // the database file found for the requested time and its version.
+     struct CacheKey_t {
+       TString  db;               // Database name (e.g. "cratemap")
+       Long64_t dev, ino;         // Identity of the file that was read
+       Long64_t size, mtime;      // File version
+       bool operator<( const CacheKey_t& rhs ) const;
+     };
+     typedef std::map< CacheKey_t, std::vector<CrateInfo_t> > Cache_t;
+     static Cache_t& GetCache();
+#endif
      void incrNslot(int crate);
      void setUsed(int crate,int slot);
      void setClear(int crate,int slot,bool clear);
@@ -160,6 +179,13 @@ int THaCrateMap::getModel(int crate, int slot) const
   return crdat[crate].model[slot];
 }
 
+inline
+const char* THaCrateMap::getConfig(int crate, int slot) const
+{
+  assert( crate >= 0 && crate < MAXROC && slot >= 0 && slot < MAXSLOT );
+  return crdat[crate].config[slot].Data();
+}
+
 inline
 int THaCrateMap::getMask(int crate, int slot) const
 {
@@ -26,6 +26,12 @@ public:
 	     const std::string& _sv, const std::string& _un, Double_t _dv ) :
     tag(_tg), dtime(_dt), evnum(_ev), svalue(_sv), units(_un), dvalue(_dv)
   { MakeTime(); }
+  // With precomputed time stamp, when many channels share one date
+  EpicsChan( const std::string& _tg, const std::string& _dt, Int_t _ev,
+	     const std::string& _sv, const std::string& _un, Double_t _dv,
+	     Double_t _ts ) :
+    tag(_tg), dtime(_dt), evnum(_ev), svalue(_sv), units(_un), dvalue(_dv),
+    timestamp(_ts) {}
   virtual ~EpicsChan() {}
   void Load(char *tg, char *dt, Int_t ev, 
             char *sv, char *un, Double_t dv) {
@@ -37,15 +43,16 @@ public:
   std::string GetTag() const    { return tag;    };
   std::string GetDate() const   { return dtime;  };
   Double_t GetTimeStamp() const { return timestamp; };
-  void MakeTime() {
+  void MakeTime() { timestamp = TimeStamp(dtime.c_str()); }
+  static Double_t TimeStamp( const char* date ) {
     // time is a continuous parameter.  funny things happen
     // at midnight or new month, but you'll figure it out.
     char t1[41],t2[41],t3[41],t4[41];
-    int day, hour, min, sec;
-    sscanf(dtime.c_str(),"%40s %40s %6d %6d:%6d:%6d %40s %40s",
+    int day = 0, hour = 0, min = 0, sec = 0;
+    sscanf(date,"%40s %40s %6d %6d:%6d:%6d %40s %40s",
 	   t1,t2,&day,&hour,&min,&sec,t3,t4);
-    timestamp = 3600*24*day + 3600*hour + 60*min + sec;
-  }  
+    return 3600*24*day + 3600*hour + 60*min + sec;
+  }
   std::string GetString() const { return svalue; };
   std::string GetUnits() const  { return units;  };
     
@@ -73,11 +80,30 @@ public:
    Bool_t IsLoaded(const char* tag) const;
    void Print();
 
+// Access by tag ID.  GetTagID registers the tag if it has not been seen
+// yet, so clients can resolve their tags once, before any data arrive.
+   Int_t GetTagID(const char* tag);
+   Bool_t IsLoaded(Int_t id) const;
+   Double_t GetData(Int_t id, int event=0) const;
+   std::string GetString(Int_t id, int event=0) const;
+   Double_t GetTimeStamp(Int_t id, int event=0) const;
+
 private:
 
-   std::map< std::string, std::vector<EpicsChan> > epicsData;
-   std::vector<EpicsChan> GetChan(const char *tag) const;
-   Int_t FindEvent(const std::vector<EpicsChan>& ep, int event) const;
+   struct Series_t {               // All readings of one tag
+     Series_t() : fSorted(kTRUE) {}
+     std::vector<EpicsChan> fChan;
+     Bool_t fSorted;               // Event numbers are non-decreasing
+   };
+   std::map< std::string, Int_t > fTagID;   // tag -> index into fSeries
+   std::vector< std::string > fTags;        // index -> tag
+   std::vector< Series_t > fSeries;
+   std::vector< Int_t > fLineTag;           // tag ID by line of last event
+
+   const Series_t* GetChan(const char *tag) const;
+   const Series_t* GetChan(Int_t id) const;
+   Int_t Intern(const char* tag, size_t len);
+   Int_t FindEvent(const Series_t* ep, int event) const;
 
    ClassDef(THaEpics,0)  // EPICS data 
 
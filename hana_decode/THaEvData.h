@@ -93,6 +93,14 @@ public:
   virtual TString GetEpicsString(const char* tag, Int_t event=0) const;
   virtual Bool_t IsLoadedEpics(const char* /*tag*/ ) const
   { return false; }
+  // Same by tag ID, avoiding the name lookup. IDs are obtained once
+  // from GetEpicsTagID and are negative if EPICS is not supported.
+  virtual Int_t GetEpicsTagID(const char* /*tag*/ ) { return -1; }
+  virtual double GetEpicsData(Int_t id, Int_t event=0) const;
+  virtual double GetEpicsTime(Int_t id, Int_t event=0) const;
+  virtual TString GetEpicsString(Int_t id, Int_t event=0) const;
+  virtual Bool_t IsLoadedEpics(Int_t /*id*/ ) const
+  { return false; }
 
   virtual void PrintSlotData(Int_t crate, Int_t slot) const;
   virtual void PrintOut() const;
@@ -107,6 +115,35 @@ public:
   void    SetOrigPS( Int_t event_type );
   TString GetOrigPS() const;
 
+  // Demand-driven decoding. Clients announce the crates/slots they read
+  // via GetData/GetNumHits etc. If enabled, the decoder skips the rest.
+  void    EnableDemandDecoding( Bool_t enable=true );
+  Bool_t  DemandDecodingEnabled() const;
+  void    ClearRequests();
+  void    RequestAll();
+  void    RequestCrate( Int_t crate );
+  void    RequestSlot( Int_t crate, Int_t slot );
+  Bool_t  IsRequested( Int_t crate ) const;
+  Bool_t  IsRequested( Int_t crate, Int_t slot ) const;
+
+  // Decoder diagnostics. Counters are always collected, per crate and
+  // slot, and accumulate until ClearDecoderStats is called.
+  enum EDecStat { kStatWords = 0,     // Words decoded by slot
+		  kStatUnclaimed,     // Words in crate not claimed by a slot
+		  kStatSynchMiss,     // Events with synch miss flag
+		  kStatSynchExtra,    // Events with extra-hits flag
+		  kStatSlotMismatch,  // Words from slot not in crate map
+		  kStatOverrun,       // Slot data ran past end of buffer
+		  kStatErrors,        // Decoding errors
+		  kNDecStat };
+  // slot < 0 sums over the crate, crate < 0 over all crates.
+  // slot == MAXSLOT gives the counts not attributed to any slot.
+  ULong64_t GetDecoderStat( EDecStat which, Int_t crate=-1,
+			    Int_t slot=-1 ) const;
+  void      ClearDecoderStats();
+  void      PrintDecoderStats( Option_t* opt="" ) const;
+  static const char* GetDecoderStatName( EDecStat which );
+
   UInt_t  GetInstance() const { return fInstance; }
   static UInt_t GetInstances() { return fgInstances.CountBits(); }
 
@@ -129,6 +166,8 @@ protected:
   enum {
     kHelicityEnabled = BIT(14),
     kScalersEnabled  = BIT(15),
+    kDemandDecoding  = BIT(16),
+    kRequestAll      = BIT(17)
   };
 
   // static const Int_t MAXROC = 32;
@@ -195,6 +234,15 @@ protected:
   TString fCrateMapName; // Crate map database file name to use
   Bool_t fNeedInit;  // Crate map needs to be (re-)initialized
 
+  UInt_t fSlotReq[Decoder::MAXROC]; // Bit pattern of requested slots per crate
+  Bool_t fReqChanged;               // Requests changed since last decode
+
+  // Diagnostic counters, kNDecStat per (crate,slot). Slot index MAXSLOT
+  // holds counts that cannot be attributed to a slot.
+  ULong64_t* fDecStat;  //! [MAXROC*(MAXSLOT+1)*kNDecStat]
+  void CountStat( EDecStat which, Int_t crate, Int_t slot=Decoder::MAXSLOT,
+		  ULong64_t n=1 );
+
   Int_t  fDebug;     // Debug/verbosity level
 
   ClassDef(THaEvData,0)  // Decoder for CODA event buffer
@@ -223,6 +271,13 @@ inline Bool_t THaEvData::GoodIndex( Int_t crate, Int_t slot ) const {
   return ( GoodCrateSlot(crate,slot) && crateslot[idx(crate,slot)] != 0);
 }
 
+inline void THaEvData::CountStat( EDecStat which, Int_t crate, Int_t slot,
+				  ULong64_t n ) {
+  if( crate < 0 || crate >= Decoder::MAXROC ) return;
+  if( slot < 0 || slot > Decoder::MAXSLOT ) slot = Decoder::MAXSLOT;
+  fDecStat[(crate*(Decoder::MAXSLOT+1)+slot)*kNDecStat+which] += n;
+}
+
 inline Int_t THaEvData::GetRocLength(Int_t crate) const {
   assert(crate >= 0 && crate < Decoder::MAXROC);
   return rocdat[crate].len;
@@ -360,6 +415,31 @@ Bool_t THaEvData::ScalersEnabled() const
   return TestBit(kScalersEnabled);
 }
 
+inline
+Bool_t THaEvData::DemandDecodingEnabled() const
+{
+  // Test if demand-driven decoding enabled
+  return TestBit(kDemandDecoding);
+}
+
+inline
+Bool_t THaEvData::IsRequested( Int_t crate ) const
+{
+  // True if any slot in the given crate is to be decoded
+  assert( crate >= 0 && crate < Decoder::MAXROC );
+  return ( !TestBit(kDemandDecoding) || TestBit(kRequestAll) ||
+	   fSlotReq[crate] != 0 );
+}
+
+inline
+Bool_t THaEvData::IsRequested( Int_t crate, Int_t slot ) const
+{
+  // True if the given crate/slot is to be decoded
+  assert( GoodCrateSlot(crate,slot) );
+  return ( !TestBit(kDemandDecoding) || TestBit(kRequestAll) ||
+	   (fSlotReq[crate] & (1U<<slot)) != 0 );
+}
+
 // Dummy versions of EPICS data access functions. These will always fail
 // in debug mode unless IsLoadedEpics is changed. This is by design -
 // clients should never try to retrieve data that are not loaded.
@@ -385,4 +465,25 @@ TString THaEvData::GetEpicsString(const char* /*tag*/,
   return TString("");
 }
 
+inline
+double THaEvData::GetEpicsData(Int_t /*id*/, Int_t /*event*/ ) const
+{
+  assert(IsLoadedEpics(-1) && fgAllowUnimpl);
+  return kBig;
+}
+
+inline
+double THaEvData::GetEpicsTime(Int_t /*id*/, Int_t /*event*/ ) const
+{
+  assert(IsLoadedEpics(-1) && fgAllowUnimpl);
+  return kBig;
+}
+
+inline
+TString THaEvData::GetEpicsString(Int_t /*id*/, Int_t /*event*/ ) const
+{
+  assert(IsLoadedEpics(-1) && fgAllowUnimpl);
+  return TString("");
+}
+
 #endif
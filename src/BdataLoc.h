@@ -54,6 +54,9 @@ public:
   virtual const char* GetTypeKey() const = 0;
   // Optional data passed in via generic pointer
   virtual Int_t   OptionPtr( void* ) { return 0; }
+  // Register decoded crate/slot data needed by Load() with the decoder.
+  // Raw buffer access (headers, ROC lengths) needs no request.
+  virtual void    RequestDecoderData( THaEvData& ) const {}
 
   virtual void    Clear( const Option_t* ="" )  { data = THaAnalysisObject::kBig; }
   virtual Bool_t  DidLoad() const               { return (data != THaAnalysisObject::kBig); }
@@ -107,6 +110,7 @@ public:
   virtual Int_t  GetNparams() const       { return fgThisType->fNparams; }
   virtual const char* GetTypeKey() const  { return fgThisType->fDBkey; };
   virtual void    Print( Option_t* opt="" ) const;
+  virtual void    RequestDecoderData( THaEvData& evt ) const;
 
   // virtual Bool_t operator==( const BdataLoc& rhs ) const
   // { return (crate == rhs.crate && slot == rhs.slot && chan == rhs.chan); }
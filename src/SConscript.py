@@ -43,6 +43,9 @@ THaEvtTypeHandler.C       THaScalerEvtHandler.C
 normanalist = ['THaNormAna.C']
 
 baseenv.Object('main.C')
+baseenv.Object('formbench_main.C')
+baseenv.Object('varbench_main.C')
+baseenv.Object('vhistbench_main.C')
 
 sotarget = 'HallA'
 normanatarget = 'NormAna'
@@ -22,6 +22,7 @@ public:
 
   virtual void   Clear( Option_t* opt = "" );
   virtual Int_t  Decode( const THaEvData& evdata );
+  virtual void   RequestDecoderData( THaEvData& evdata ) const;
 
   THaADCHelicity() {}  // For ROOT I/O only
 
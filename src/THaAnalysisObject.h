@@ -63,6 +63,9 @@ public:
   virtual Int_t        InitOutput( THaOutput * );
           Bool_t       IsOKOut()                 { return fOKOut; }
 
+  // Tell the decoder which crates/slots this object reads
+  virtual void         RequestDecoderData( THaEvData& evdata ) const;
+
   // Static functions to provide easy access to database files
   // from CINT scripts etc.
   static  FILE*   OpenFile( const char* name, const TDatime& date,
@@ -37,10 +37,18 @@ public:
           Int_t  Process( THaRunBase& run ) { return Process(&run); }
   virtual void   Print( Option_t* opt="" ) const;
 
+  void           EnableAsyncOutput( Bool_t b = kTRUE );
   void           EnableBenchmarks( Bool_t b = kTRUE );
+  void           EnableCutFlow( Bool_t b = kTRUE );
+  void           EnableDecoderStats( Bool_t b = kTRUE );
+  void           EnableDemandDecoding( Bool_t b = kTRUE );
   void           EnableHelicity( Bool_t b = kTRUE );
+  void           EnableNativeFormulas( Bool_t b = kTRUE,
+				       const char* cachedir = 0 );
   void           EnableOtherEvents( Bool_t b = kTRUE );
   void           EnableOverwrite( Bool_t b = kTRUE );
+  void           EnableParallelCompression( Bool_t b = kTRUE,
+					    UInt_t nthreads = 0 );
   void           EnablePhysicsEvents( Bool_t b = kTRUE );
   void           EnableRunUpdate( Bool_t b = kTRUE );
   void           EnableScalers( Bool_t b = kTRUE );
@@ -51,6 +59,7 @@ public:
   const char*    GetSummaryFileName()  const  { return fSummaryFileName.Data(); }
   TFile*         GetOutFile()          const  { return fFile; }
   Int_t          GetCompressionLevel() const  { return fCompress; }
+  Int_t          GetCompressionAlgorithm() const { return fCompressAlgo; }
   THaEvent*      GetEvent()            const  { return fEvent; }
   THaEvData*     GetDecoder()          const  { return fEvData; }
   TList*         GetApps()             const  { return fApps; }
@@ -58,9 +67,15 @@ public:
   TList*         GetScalers()          const  { return fScalers; }
   TList*         GetPostProcess()      const  { return fPostProcess; }
   Bool_t         HasStarted()          const  { return fAnalysisStarted; }
+  Bool_t         AsyncOutputEnabled()  const  { return fDoAsyncOut; }
+  Bool_t         CutFlowEnabled()      const  { return fDoCutFlow; }
+  Bool_t         DemandDecodingEnabled() const { return fDoDemandDecoding; }
+  Bool_t         DecoderStatsEnabled() const  { return fDoDecStats; }
   Bool_t         HelicityEnabled()     const  { return fDoHelicity; }
+  Bool_t         NativeFormulasEnabled() const { return fDoNative; }
   Bool_t         PhysicsEnabled()      const  { return fDoPhysics; }
   Bool_t         OtherEventsEnabled()  const  { return fDoOtherEvents; }
+  Bool_t         ParallelCompressionEnabled() const { return fDoParCompress; }
   Bool_t         ScalersEnabled()      const  { return fDoScalers; }
   Bool_t         SlowControlEnabled()  const  { return fDoSlowControl; }
   virtual Int_t  SetCountMode( Int_t mode );
@@ -71,6 +86,7 @@ public:
   void           SetOdefFile( const char* name ) { fOdefFileName = name; }
   void           SetSummaryFile( const char* name ) { fSummaryFileName = name; }
   void           SetCompressionLevel( Int_t level ) { fCompress = level; }
+  void           SetCompressionAlgorithm( Int_t algo ) { fCompressAlgo = algo; }
   void           SetMarkInterval( UInt_t interval ) { fMarkInterval = interval; }
   void           SetVerbosity( Int_t level )        { fVerbose = level; }
 
@@ -115,6 +131,7 @@ protected:
   TString        fLoadedCutFileName;//Name of last loaded cut definition file
   TString        fOdefFileName;    //Name of output definition file
   TString        fSummaryFileName; //Name of test/cut statistics output file
+  TString        fNativeCacheDir;  //Cache directory for compiled formulas
   THaEvent*      fEvent;           //The event structure to be written to file.
   Int_t          fNStages;         //Number of analysis stages
   Int_t          fNCounters;       //Number of counters
@@ -123,6 +140,8 @@ protected:
   UInt_t         fNev;             //Number of events read during most recent replay
   UInt_t         fMarkInterval;    //Interval for printing event numbers
   Int_t          fCompress;        //Compression level for ROOT output file
+  Int_t          fCompressAlgo;    //Compression algorithm (0 = ROOT default)
+  UInt_t         fNCompThreads;    //Threads for parallel compression (0 = auto)
   Int_t          fVerbose;         //Verbosity level
   Int_t          fCountMode;       //Event counting mode (see ECountMode)
   THaBenchmark*  fBench;           //Counters for timing statistics
@@ -147,6 +166,12 @@ protected:
   Bool_t         fDoOtherEvents;   // Enable other event processing
   Bool_t         fDoScalers;       // Enable scaler processing
   Bool_t         fDoSlowControl;   // Enable slow control processing
+  Bool_t         fDoDemandDecoding;// Decode only crates/slots used by modules
+  Bool_t         fDoDecStats;      // Write decoder statistics tree
+  Bool_t         fDoNative;        // Compile formulas/cuts to machine code
+  Bool_t         fDoCutFlow;       // Collect and write cut flow statistics
+  Bool_t         fDoAsyncOut;      // Fill output tree in a writer thread
+  Bool_t         fDoParCompress;   // Compress output baskets in parallel
 
   // Variables used by analysis functions
   Bool_t         fFirstPhysics;    // Status flag for physics analysis
@@ -172,6 +197,7 @@ protected:
   virtual bool   EvalStage( int n );
   virtual void   InitCounters();
   virtual void   InitCuts();
+  virtual void   InitDecoderRequests();
   virtual void   InitStages();
   virtual Int_t  InitModules( TList* module_list, TDatime& time,
 			      Int_t erroff, const char* baseclass = NULL );
@@ -180,6 +206,7 @@ protected:
   virtual void   PrintCounters() const;
   virtual void   PrintScalers() const;
   virtual void   PrintCutSummary() const;
+  virtual void   WriteDecoderStats() const;
 
   static THaAnalyzer* fgAnalyzer;  //Pointer to instance of this class
 
@@ -29,6 +29,7 @@ public:
 
   virtual EStatus      Init( const TDatime& run_time );
   virtual void         Print( Option_t* opt="" ) const;
+  virtual void         RequestDecoderData( THaEvData& evdata ) const;
   virtual Int_t        CoarseReconstruct() { return 0; }
   virtual Int_t        Reconstruct() = 0;
   virtual void         SetDebugAll( Int_t level );
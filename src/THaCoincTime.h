@@ -32,6 +32,7 @@ public:
   
   virtual EStatus   Init( const TDatime& run_time );
   virtual Int_t     Process( const THaEvData& );
+  virtual void      RequestDecoderData( THaEvData& evdata ) const;
 
  protected:
 
@@ -23,34 +23,65 @@ public:
 
   enum EvalMode { kModeErr = -1, kAND, kOR, kXOR };
 
-          void         ClearResult()        { fLastResult = kFALSE; }
+          void         ClearResult()   { StoreResult(kFALSE); Invalidate(); }
   // Requires ROOT >= 4.00/00
   virtual Int_t        DefinedVariable( TString& variable, Int_t& action );
   virtual Double_t     Eval();
   // For backward compatibility
-          Bool_t       EvalCut()            { Eval(); return fLastResult; }
+          Bool_t       EvalCut()            { Eval(); return GetResult(); }
+  // Evaluate at most once per event (see THaFormula::EvalCached)
+          Bool_t       EvalCutCached();
           const char*  GetBlockname() const { return fBlockname.Data(); }
           EvalMode     GetMode()      const { return fMode; }
           UInt_t       GetNCalled()   const { return fNCalled; }
           UInt_t       GetNPassed()   const { return fNPassed; }
-          Bool_t       GetResult()    const { return fLastResult; }
+          Double_t     GetTime()      const { return fTime; }
+          Bool_t       GetResult()    const
+    { return fResultWord ? (*fResultWord & fResultMask) != 0 : fLastResult; }
+  // Cuts whose logical AND this cut is, if its expression is nothing else
+          Bool_t       GetConjunction( std::vector<THaCut*>& terms ) const;
   virtual Bool_t       IsArray()      const { return kFALSE; }
   virtual Bool_t       IsVarArray()   const { return kFALSE; }
   virtual void         Print( Option_t *opt="" ) const;
   virtual void         Reset();
   virtual void         SetBlockname( const Text_t* name );
+  // Record a result obtained without evaluating the expression
+          void         SetResult( Bool_t result );
   virtual void         SetName( const Text_t* name );
   virtual void         SetNameTitle( const Text_t* name, const Text_t* title );
 
+  // Measure the time spent in Eval() of all cuts (see GetTime)
+  static  void         EnableTiming( Bool_t b = kTRUE ) { fgTiming = b; }
+  static  Bool_t       TimingEnabled() { return fgTiming; }
+
 protected:
-  Bool_t      fLastResult;  // Result of last evaluation of this formula
+  Bool_t      fLastResult;  // Result of last evaluation, if not in a cut list
   TString     fBlockname;   // Name of block this cut belongs to
   UInt_t      fNCalled;     // Number of times this cut has been evaluated
   UInt_t      fNPassed;     // Number of times this cut was true when evaluated
   EvalMode    fMode;        // Evaluation mode of array expressions (AND/OR etc)
+  Double_t    fTime;        //! Total time spent in Eval() while timing (s)
+  UInt_t*     fResultWord;  //! Word of the cut list's result bits, if any
+  UInt_t      fResultMask;  //! Bit of this cut in *fResultWord
+
+  static Bool_t fgTiming;   // Measure evaluation times
 
+  void        BindResult( UInt_t* word, UInt_t mask );
   Bool_t      EvalElement( Int_t instance );
+  void        EvalNoTiming();
   EvalMode    ParsePrefix( TString& expr );
+  virtual TString ResultKey() const;
+  void        StoreResult( Bool_t result )
+  {
+    if( !fResultWord )
+      fLastResult = result;
+    else if( result )
+      *fResultWord |= fResultMask;
+    else
+      *fResultWord &= ~fResultMask;
+  }
+
+  friend class THaCutList;
 
   ClassDef(THaCut,0)   // A logical cut (a.k.a. test)
 };
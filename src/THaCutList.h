@@ -10,8 +10,11 @@
 #include "THashList.h"
 #include "THaCut.h"
 #include "THaNamedList.h"
+#include <vector>
+#include <iosfwd>
 
 class TList;
+class TDirectory;
 class THaVarList;
 class THaPrintOption;
 
@@ -47,13 +50,16 @@ public:
   virtual void      ClearBlock( const char* block=kDefaultBlockName,
 				Option_t* opt="" );
   virtual void      Compile();
+          Bool_t    CutFlowEnabled() const { return fCutFlow; }
   virtual Int_t     Define( const char* cutname, const char* expr, 
 			    const char* block=kDefaultBlockName );
   virtual Int_t     Define( const char* cutname, const char* expr,
 			    const THaVarList* lst, 
 			    const char* block=kDefaultBlockName );
+          void      EnableCutFlow( Bool_t enable = kTRUE );
   virtual Int_t     Eval();
   virtual Int_t     EvalBlock( const char* block=kDefaultBlockName );
+          Bool_t    EvalBlockResult( const TList* plist, THaCut* master );
   THaCut*           FindCut( const char* name ) const
     { return static_cast<THaCut*>(fCuts->FindObject( name )); }
   THaNamedList*     FindBlock( const char* block ) const
@@ -62,16 +68,20 @@ public:
   const THashList*  GetBlockList() const { return fBlocks; } //in future versions
           Int_t     GetNblocks()   const { return fBlocks->GetSize(); }
           Int_t     GetSize()      const { return fCuts->GetSize(); }
+          Bool_t    IsAdaptive()   const { return fAdaptive; }
   virtual Int_t     Load( const char* filename=kDefaultCutFile );
   virtual void      Print( Option_t* option="" ) const;
   virtual void      PrintCut( const char* cutname, Option_t* option="" ) const;
+  virtual void      PrintCutFlow( Option_t* option="" ) const;
   virtual void      PrintBlock( const char* block=kDefaultBlockName, 
 				Option_t* option="" ) const;
   virtual void      Reset();
   virtual Int_t     Result( const char* cutname = "", EWarnMode mode=kWarn );
   virtual Int_t     Remove( const char* cutname );
   virtual Int_t     RemoveBlock( const char* block=kDefaultBlockName );
+          void      SetAdaptive( Bool_t enable = kTRUE, Int_t interval = 1000 );
   virtual void      SetList( THaVarList* lst );
+  virtual Int_t     WriteCutFlow( TDirectory* dir ) const;
 
   static  Int_t     EvalBlock( const TList* plist );
 
@@ -80,6 +90,73 @@ protected:
   THaHashList*      fBlocks;  //Hash list holding blocks of cuts.
                               //Elements of this table are THaNamedLists of THaCuts
   const THaVarList* fVarList; //Pointer to list of variables
+  Bool_t            fAdaptive; //Short-circuit block evaluation (SetAdaptive)
+  Int_t             fReorderInterval; //Block evaluations between reorderings
+  UInt_t            fPlanGen;  //Incremented whenever cuts change
+  Bool_t            fCutFlow;  //Collect cut flow statistics (EnableCutFlow)
+  UInt_t            fFlatGen;  //fPlanGen when the flat arrays were made
+
+#ifndef __CINT__
+  // All cuts in a contiguous array, grouped by block, and their results
+  // as a bit vector (see MakeFlat)
+  struct FlatConj_t {
+    Int_t cut;    // Index in fFlatCuts of a cut that is an AND of cuts
+    std::vector< std::pair<Int_t,UInt_t> > words; // Words/bits of its terms
+  };
+  struct FlatBlock_t {
+    const TList* list;
+    Int_t        begin, end;  // Range of the block in fFlatCuts
+    Int_t        cbegin, cend;  // Range of its conjunctions in fFlatConj
+  };
+  std::vector<THaCut*>     fFlatCuts;    //! All cuts, grouped by block
+  std::vector<FlatBlock_t> fFlatBlocks;  //! Blocks, in order of definition
+  std::vector<FlatConj_t>  fFlatConj;    //! Conjunctions of earlier cuts
+  std::vector<UInt_t>      fResultBits;  //! Result of fFlatCuts[i] in bit i
+
+  Bool_t            AllPassed( const FlatConj_t& conj ) const;
+  const FlatBlock_t* GetFlatBlock( const TList* plist );
+  void              EvalFlat( const FlatBlock_t& blk );
+  void              MakeFlat();
+
+  // Evaluation plan of a block for adaptive mode (see EvalBlockResult)
+  struct CutTerm_t {
+    THaCut*  cut;
+    Double_t ncalled;   // Number of evaluations counted in this plan
+    Double_t npassed;   // Number of those that passed
+    Double_t nsampled;  // Number of evaluations that were timed
+    Double_t time;      // Total time of the timed evaluations (s)
+  };
+  struct BlockPlan_t {
+    const TList*           list;
+    THaCut*                master;
+    UInt_t                 gen;     // fPlanGen when this plan was made
+    Bool_t                 conj;    // Master is an AND of the terms
+    Int_t                  neval;   // Evaluations since last reordering
+    std::vector<CutTerm_t> terms;
+  };
+  std::vector<BlockPlan_t> fPlans;  //! Plans by block
+
+  Bool_t            EvalConjunction( BlockPlan_t& plan );
+  BlockPlan_t*      GetPlan( const TList* plist, THaCut* master );
+  static  void      ReorderPlan( BlockPlan_t& plan );
+
+  // Cut flow statistics of a block (see EnableCutFlow)
+  struct CutFlow_t {
+    const TList*          list;
+    TString               name;    // Block name
+    UInt_t                gen;     // fPlanGen when the cuts were found
+    std::vector<THaCut*>  cuts;
+    Double_t              nev;     // Events in which the block was evaluated
+    std::vector<Double_t> ncum;    // Events passing cuts 0..i
+    std::vector<Double_t> npair;   // Events passing cuts i and j, i<=j
+    std::vector<Bool_t>   pass;    // Results in the current event
+  };
+  std::vector<CutFlow_t> fFlows;    //! Cut flow statistics by block
+
+  void              FillCutFlow( const TList* plist );
+  void              ForgetCuts();
+  static  void      PrintFlowTable( std::ostream& os, const CutFlow_t& flow );
+#endif
 
   static  void      MakePrintOption( THaPrintOption& opt, 
 				     const TList* plist );
@@ -22,6 +22,7 @@ public:
   virtual EStatus   Init( const TDatime& run_time );
   virtual void      Print( Option_t* opt="" ) const;
   virtual Int_t     Process( const THaEvData& evdata );
+  virtual void      RequestDecoderData( THaEvData& evdata ) const;
 
 protected:
 
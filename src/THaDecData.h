@@ -24,6 +24,7 @@ public:
   virtual void    Clear( Option_t* opt="" );
   virtual Int_t   Decode( const THaEvData& );
   virtual void    Print( Option_t* opt="" ) const;
+  virtual void    RequestDecoderData( THaEvData& evdata ) const;
 
   // Disabled functions from THaApparatus
   virtual Int_t   AddDetector( THaDetector* det ) { return 0; }
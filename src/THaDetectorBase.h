@@ -35,6 +35,8 @@ public:
 
   Bool_t           IsInActiveArea( Double_t x, Double_t y ) const;
 
+  virtual void     RequestDecoderData( THaEvData& evdata ) const;
+
   Int_t            FillDetMap( const std::vector<Int_t>& values,
 			       UInt_t flags=0,
 			       const char* here = "FillDetMap" );
@@ -11,6 +11,7 @@
 #include "THaGlobals.h"
 #include "RVersion.h"
 #include <vector>
+#include <iosfwd>
 
 class THaVarList;
 class THaCutList;
@@ -30,6 +31,7 @@ public:
   virtual ~THaFormula();
 
   virtual Int_t       Compile( const char* expression="" );
+          Int_t       ReAttachVars();
   virtual char*       DefinedString( Int_t i );
   virtual Double_t    DefinedValue( Int_t i );
   // Requires ROOT >= 4.00/00
@@ -44,15 +46,51 @@ public:
   // need to hack this-pointer to be non-const - courtesy of ROOT team
   { return const_cast<THaFormula*>(this)->Eval(); }
   virtual Double_t    EvalInstance( Int_t instance );
+          Int_t       EvalAll( Double_t* dst, Int_t n );
   virtual Int_t       GetNdata()   const;
   virtual Bool_t      IsArray()    const { return TestBit(kArrayFormula); }
   virtual Bool_t      IsVarArray() const { return TestBit(kVarArray); }
           Bool_t      IsError()    const { return TestBit(kError); }
+          Bool_t      HasBytecode() const { return !fCode.empty(); }
+          Bool_t      HasNativeCode() const { return fNative != 0; }
           Bool_t      IsInvalid()  const { return TestBit(kInvalid); }
   virtual void        Print( Option_t* option="" ) const;
           void        SetList( const THaVarList* lst )    { fVarList = lst; }
           void        SetCutList( const THaCutList* lst ) { fCutList = lst; }
 
+  // Evaluate formulas with the bytecode compiled from the TFormula program
+  // (default), or with TFormula::EvalPar
+  static  void        UseBytecode( Bool_t enable = kTRUE ) { fgUseCode = enable; }
+  static  Bool_t      IsBytecodeEnabled() { return fgUseCode; }
+
+  // Per-event result cache. EvalCached() returns the result of the last
+  // Eval() of this formula if it was done in the current event (see
+  // NextEvent). Otherwise, it returns the result of any formula with the
+  // same expression, type, and variable and cut lists, e.g. the same cut
+  // in an output definition and a histogram, if that was obtained in the
+  // current stage of the event (see NextStage), since the variables may
+  // have changed between stages.
+          Double_t    EvalCached();
+          void        Invalidate()
+    { fEvalGen = 0; if( fResult ) fResult->gen = 0; }
+  static  void        NextEvent();
+  static  void        NextStage();
+  static  void        EndEvents();
+  static  Bool_t      InEventLoop() { return fgInEvent; }
+  static  UInt_t      GetEventGeneration() { return fgEventGen; }
+
+  // Compile the bytecode of all formulas to machine code (opt-in)
+  static  Int_t       CompileNative( const char* cachedir = 0 );
+  static  void        ClearNative();
+
+  // Evaluate common subexpressions of shareable formulas once per
+  // generation (see BuildShared and InvalidateShared)
+          void        SetShareable( Bool_t b = kTRUE ) { fShareable = b; }
+          Bool_t      IsShared()   const { return fShared >= 0; }
+  static  Int_t       BuildShared();
+  static  void        ClearShared();
+  static  void        InvalidateShared();
+
 #if ROOT_VERSION_CODE >= 331529 && ROOT_VERSION_CODE < 334336// 5.15/09-5.26/00
   // Workaround for buggy TFormula
   virtual TString     GetExpFormula( Option_t* opt="" ) const;
@@ -75,15 +113,116 @@ protected:
     EVariableType type;                //Type of variable in the formula
     void*         obj;                 //Pointer to the respective object
     Int_t         index;               //Linear index into array, if fixed-size
+    Int_t         handle;              //Global variable handle (see THaVarList)
+    UInt_t        gen;                 //Generation of handle when resolved
+    UInt_t        layout;              //Type/array layout signature of variable
+    const void*   addr;                //Bound data address, if basic type
+    Int_t         vtype;               //VarType of data at addr
+    Int_t         len;                 //Number of elements at addr
     FVarDef_t( EVariableType t, void* p, Int_t i )
-      : type(t), obj(p), index(i) {}
+      : type(t), obj(p), index(i), handle(-1), gen(0), layout(0), addr(0),
+	vtype(0), len(0) {}
   };
   std::vector<FVarDef_t> fVarDef;      //Global variables referenced in formula
+
+  // Register bytecode generated from the TFormula operator list. Register r
+  // corresponds to stack position r of the TFormula evaluator.
+  enum ECodeOp { kOpConst, kOpVar, kOpJump, kOpJumpIfNot, kOpAndSkip,
+		 kOpOrSkip,
+		 // Unary (dst = a)
+		 kOpNeg, kOpNot, kOpCos, kOpSin, kOpTan, kOpACos, kOpASin,
+		 kOpATan, kOpCosH, kOpSinH, kOpTanH, kOpACosH, kOpASinH,
+		 kOpATanH, kOpSq, kOpSqrt, kOpLog, kOpExp, kOpLog10, kOpAbs,
+		 kOpSign, kOpInt,
+		 // Binary (dst = a, b = a+1)
+		 kOpAdd, kOpSub, kOpMul, kOpDiv, kOpMod, kOpPow, kOpATan2,
+		 kOpFmod, kOpMin, kOpMax, kOpAnd, kOpOr, kOpEq, kOpNe, kOpLt,
+		 kOpGt, kOpLe, kOpGe, kOpBitAnd, kOpBitOr, kOpShl, kOpShr };
+  struct FCode_t {
+    Int_t  op;        //ECodeOp
+    Int_t  dst;       //Destination register
+    Int_t  arg;       //Constant/variable index, or jump target
+    FCode_t( Int_t o, Int_t d, Int_t a ) : op(o), dst(d), arg(a) {}
+  };
+  std::vector<FCode_t>  fCode;         //Bytecode, empty if not compilable
+  std::vector<Double_t> fCodeConst;    //Constants used by bytecode
+  std::vector<Double_t> fReg;          //Registers
+  std::vector<Double_t> fVarVal;       //Values of variables, per evaluation
+  static Bool_t         fgUseCode;     //Evaluate with bytecode if available
+  Bool_t                fCodeAll;      //Bytecode can run on all instances
+  std::vector<Double_t> fAllReg;       //Registers for EvalCodeAll
+  std::vector<Double_t> fAllVal;       //Variable values for EvalCodeAll
+  std::vector<UChar_t>  fAllBad;       //Invalid flags for EvalCodeAll
+
+  // Natively compiled bytecode (see CompileNative). Arguments are the
+  // constants, a function returning the variable values, and this formula.
+  typedef Double_t* (*NativeLoad_t)( void* );
+  typedef Double_t  (*NativeFunc_t)( const Double_t*, NativeLoad_t, void* );
+  NativeFunc_t          fNative;       //! Compiled function, if any
+
+  // Node of the graph of subexpressions shared between formulas
+  struct FNode_t {
+    Int_t         op;        //ECodeOp
+    Int_t         a;         //First operand node, or index of variable
+    Int_t         b;         //Second operand node
+    Double_t      c;         //Value of constant
+    const THaVar* var;       //Variable, if op == kOpVar
+    UInt_t        gen;       //fgSharedGen of val
+    Double_t      val;       //Value in generation gen
+    Bool_t        bad;       //Variable index out of range in generation gen
+  };
+  static std::vector<FNode_t> fgNodes; //Shared subexpression graph
+  static UInt_t         fgSharedGen;   //Current generation
+  Bool_t                fShareable;    //! Include in BuildShared
+  Int_t                 fShared;       //! Root node in fgNodes, or -1
+  std::vector<Int_t>    fSharedVars;   //! Variable nodes in fgNodes
   const THaVarList* fVarList;          //Pointer to list of variables
   const THaCutList* fCutList;          //Pointer to list of cuts
   Int_t             fInstance;         //Current instance to evaluate
+  UInt_t            fEvalGen;          //! Event generation of fEvalValue
+  Double_t          fEvalValue;        //! Result of last Eval()
+  static UInt_t     fgEventGen;        //Current event generation
+  static Bool_t     fgInEvent;         //Between NextEvent and EndEvents
+  static UInt_t     fgStageGen;        //Current stage generation
+
+  // Result of the current event, shared by all formulas with the same
+  // ResultKey(). Entries are reference counted and owned by a registry.
+  struct FResult_t {
+    UInt_t        gen;                 //Stage generation of value
+    Double_t      value;               //Result in generation gen
+    Int_t         nref;                //Number of formulas using the entry
+    const char*   key;                 //Key in the registry
+  };
+  FResult_t*        fResult;           //! Shared result, 0 if none
+
+          void      BindResult();
+          void      ReleaseResult();
+  virtual TString   ResultKey() const;
+          void      SetEvalResult( Double_t value )
+  {
+    fEvalValue = value;
+    fEvalGen = fgEventGen;
+    if( fResult ) {
+      fResult->value = value;
+      fResult->gen = fgStageGen;
+    }
+  }
 
+          Bool_t    CompileCode();
+          Double_t  EvalCode();
+          Double_t  EvalShared();
+  static  Double_t  EvalNode( Int_t k );
+          Int_t     MakeSharedNodes( Int_t& nops );
+  static  Int_t     AddNode( Int_t op, Int_t a, Int_t b, Double_t c,
+			     const THaVar* var );
+          void      EvalCodeAll( Double_t* dst, Int_t n );
           Double_t  EvalInstanceUnchecked( Int_t instance );
+  static  void      BindVar( FVarDef_t& def );
+          void      LoadVarValues();
+  static  Double_t* NativeLoad( void* obj );
+          void      WriteNativeSource( std::ostream& os ) const;
+  static  Double_t  EvalOp( Int_t op, Double_t a, Double_t b );
+  static  void      EvalOpAll( Int_t op, Double_t* x, Int_t n );
           Int_t     GetNdataUnchecked() const;
           Int_t     Init( const char* name, const char* expression );
   virtual Bool_t    IsString( Int_t oper ) const;
@@ -99,8 +238,31 @@ Double_t THaFormula::EvalInstanceUnchecked( Int_t instance )
   fInstance = instance;
   if( fNoper == 1 && fVarDef.size() == 1 )
     return DefinedValue(0);
+  else if( fgUseCode && fShared >= 0 && fgInEvent )
+    return EvalShared();
+  else if( fgUseCode && fNative )
+    return fNative( fCodeConst.empty() ? 0 : &fCodeConst[0], NativeLoad,
+		    this );
+  else if( fgUseCode && !fCode.empty() )
+    return EvalCode();
   else
     return EvalPar(0);
 }
 
+//_____________________________________________________________________________
+inline
+Double_t THaFormula::EvalCached()
+{
+  if( fgInEvent ) {
+    if( fEvalGen == fgEventGen )
+      return fEvalValue;
+    if( fResult && fResult->gen == fgStageGen ) {
+      fEvalValue = fResult->value;
+      fEvalGen = fgEventGen;
+      return fEvalValue;
+    }
+  }
+  return Eval();
+}
+
 #endif
@@ -27,6 +27,7 @@ public:
   virtual void   Clear( Option_t* opt = "" );
   virtual Int_t  Decode( const THaEvData& evdata );
   virtual Int_t  End( THaRunBase* r=0 );
+  virtual void   RequestDecoderData( THaEvData& evdata ) const;
   virtual void   SetDebug( Int_t level );
   virtual Bool_t HelicityValid() const { return fValidHel; }
 
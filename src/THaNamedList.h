@@ -24,11 +24,13 @@ public:
   virtual Int_t    Compare( const TObject* obj) const    
     { return fNamed->Compare(obj); }
   virtual void     FillBuffer(char*& buffer)    { fNamed->FillBuffer(buffer); }
+          Int_t    GetIndex() const             { return fIndex; }
           const Text_t*  GetName() const        { return fNamed->GetName(); }
           const Text_t*  GetTitle() const       { return fNamed->GetTitle(); }
   virtual ULong_t  Hash() const                 { return fNamed->Hash(); }
           Bool_t   IsSortable() const           { return kTRUE; }
   virtual void     PrintOpt( Option_t* opt="" ) const;
+          void     SetIndex( Int_t i )          { fIndex = i; }
   virtual void     SetName(const Text_t *name); // *MENU*
   virtual void     SetNameTitle(const Text_t *name, const Text_t *title);
   virtual void     SetTitle(const Text_t *title="") 
@@ -38,6 +40,7 @@ public:
 
 protected:
   TNamed*    fNamed;   //Name of the list
+  Int_t      fIndex;   //! Position in the owner's block array, -1 if none
 
   ClassDef(THaNamedList,0)   //A list with a name
 };
@@ -143,6 +143,7 @@ public:
    virtual Int_t   Reconstruct() { return 0; }
    virtual Int_t   Process( const THaEvData& );
    virtual Int_t   PrintSummary() const;
+   virtual void    RequestDecoderData( THaEvData& evdata ) const;
 
 private:
 
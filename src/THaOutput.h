@@ -21,19 +21,32 @@ class THaVhist;
 class THaScalerGroup;
 class THaEvData;
 class TTree;
+class THaTreeWriter;
+class THaFillTimer;
 
 class THaOdata {
 // Utility class used by THaOutput to store arrays 
 // up to size 'nsize' for tree output.
+// If 'type' is not 'D', 'data' holds elements of that native type
+// (ROOT leaf type code), and Fill(i,dat) and Get() must not be used.
 public:
-  THaOdata(int n=1) : tree(NULL), ndata(0), nsize(n)
+  THaOdata(int n=1) : tree(NULL), ndata(0), nsize(n), type('D')
   { data = new Double_t[n]; }
   THaOdata(const THaOdata& other);
   THaOdata& operator=(const THaOdata& rhs);
   virtual ~THaOdata() { delete [] data; };
-  void AddBranches(TTree* T, std::string name);
+  void AddBranches(TTree* T, std::string name, Char_t type = 'D');
   void Clear( Option_t* ="" ) { ndata = 0; }  
   Bool_t Resize(Int_t i);
+  // Make room for n elements, but at most kMaxIndex+1. Returns the
+  // number of elements that fit.
+  Int_t Reserve(Int_t n) {
+    if( n > nsize && Resize(n-1) ) {
+      Resize(kMaxIndex);
+      return kMaxIndex+1;
+    }
+    return n;
+  }
   Int_t Fill(Int_t i, Double_t dat) {
     if( i<0 || (i>=nsize && Resize(i)) ) return 0;
     if( i>=ndata ) ndata = i+1;
@@ -57,6 +70,9 @@ public:
   Int_t       ndata;   // Number of array elements
   Int_t       nsize;   // Maximum number of elements
   Double_t*   data;    // [ndata] Array data
+  Char_t      type;    // Leaf type code of the data
+
+  enum { kMaxIndex = 4096 };  // Largest index Resize() accepts
 
 private:
 
@@ -81,6 +97,12 @@ public:
   virtual Int_t End();
   virtual Bool_t TreeDefined() const { return fTree != 0; };
   virtual TTree* GetTree() const { return fTree; };
+  virtual Int_t  FlushTree();
+
+  void   SetAsyncWrite( Bool_t enable = kTRUE, Int_t depth = 0 );
+  Bool_t IsAsyncWrite() const { return fAsync; }
+  void   EnableFillTiming( Bool_t enable = kTRUE );
+  Long64_t GetCompressTime( Double_t& real, Double_t& cpu ) const;
 
   static void SetVerbosity( Int_t level );
   
@@ -91,7 +113,7 @@ protected:
   virtual Int_t FindKey(const std::string& key) const;
   virtual void  ErrFile(Int_t iden, const std::string& sline) const;
   virtual Int_t ChkHistTitle(Int_t key, const std::string& sline);
-  virtual Int_t BuildBlock(const std::string& blockn);
+  virtual Int_t BuildBlock(const std::string& blockn, Int_t store = -1);
   virtual std::string StripBracket(const std::string& var) const; 
   std::vector<std::string> reQuote(const std::vector<std::string>& input) const;
   std::string CleanEpicsName(const std::string& var) const;
@@ -100,6 +122,11 @@ protected:
          Int_t helicity = 0, Int_t slot=-1, Int_t chan=-1); 
   void DefScaler(Int_t hel = 0);
   void Print() const;
+  Bool_t IsNative(const std::string& var) const;
+  Int_t  ParseStore(const std::string& word) const;
+  Int_t StartWriter();
+  THaVform* HistForm(const std::string& expr, const std::string& name,
+		     Bool_t iscut, std::map<std::string, THaVform*>& shared);
   // Variables, Formulas, Cuts, Histograms
   Int_t fNvar;
   Double_t *fVar, *fEpicsVar;
@@ -110,16 +137,25 @@ protected:
   std::vector<THaVar* >  fVariables, fArrays;
   std::vector<THaVform* > fFormulas, fCuts;
   std::vector<THaVhist* > fHistos;
+  std::vector<THaVform* > fHistForms;  // Formulas/cuts shared by histograms
   std::vector<THaOdata* > fOdata;
   std::vector<THaEpicsKey*>  fEpicsKey;
   std::vector<THaScalerKey*> fScalerKey;
   TTree *fTree, *fEpicsTree; 
   std::map<std::string, TTree*> fScalTree;
   bool fInit;
+  std::vector<Char_t> fVarType;   // Leaf type codes of fVNames
+  std::map<std::string, Bool_t> fNativeVars; // Explicit storage choices
+  Bool_t fNativeAll;       // Store variables in native type by default
+  Bool_t fAsync;           // Fill tree in a separate writer thread
+  Int_t  fQueueDepth;      // Max number of events queued for the writer
+  THaTreeWriter* fWriter;  //! Asynchronous tree writer, if started
+  THaFillTimer*  fFillTimer; //! Timing of fills that compress baskets
   
   enum EId {kVar = 1, kForm, kCut, kH1f, kH1d, kH2f, kH2d, kBlock,
-            kBegin, kEnd, kRate, kCount };
+            kBegin, kEnd, kRate, kCount, kStore };
   static const Int_t kNbout = 4000;
+  static const Int_t kQueueDepth = 32;
   static const Int_t fgNocut = -1;
 
   static Int_t fgVerbose;
@@ -22,6 +22,7 @@ public:
   virtual ~THaTotalShower();
 
   virtual Int_t      Decode( const THaEvData& );
+  virtual void       RequestDecoderData( THaEvData& evdata ) const;
   virtual Int_t      CoarseProcess( TClonesArray& tracks );
   virtual Int_t      FineProcess( TClonesArray& tracks );
           Float_t    GetE() const           { return fE; }
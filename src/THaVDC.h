@@ -29,6 +29,7 @@ public:
   virtual Int_t FineTrack( TClonesArray& tracks );
   virtual Int_t FindVertices( TClonesArray& tracks );
   virtual EStatus Init( const TDatime& date );
+  virtual void  RequestDecoderData( THaEvData& evdata ) const;
 
   // Get and Set Functions
   virtual THaVDCUVPlane* GetUpper() { return fUpper; }
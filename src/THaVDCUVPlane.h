@@ -26,6 +26,7 @@ public:
 
   virtual void    Clear( Option_t* opt="" );    // Reset event-by-event data
   virtual Int_t   Decode( const THaEvData& evData );
+  virtual void    RequestDecoderData( THaEvData& evData ) const;
   virtual Int_t   CoarseTrack();          // Find clusters & estimate track
   virtual Int_t   FineTrack();            // More precisely calculate track
   virtual EStatus Init( const TDatime& date );
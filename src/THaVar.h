@@ -10,6 +10,7 @@
 #include "TNamed.h"
 #include "THaArrayString.h"
 #include "VarType.h"
+#include "VarDef.h"
 #include <cstddef>
 
 class TMethodCall;
@@ -21,7 +22,8 @@ public:
   static const Double_t kInvalid;
 
   THaVar() :
-    fValueP(0), fType(kDouble), fCount(0), fOffset(-1), fMethod(0), fDim(0) {}
+    fValueP(0), fType(kDouble), fCount(0), fOffset(-1), fMethod(0), fFunc(0), fDim(0)
+  { SetupGetter(); }
   THaVar( const THaVar& rhs );
   THaVar& operator=( const THaVar& );
   virtual ~THaVar();
@@ -29,89 +31,93 @@ public:
   THaVar( const char* name, const char* descript, const Double_t& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueD(&var), fType(kDouble),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const Float_t& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueF(&var), fType(kFloat),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const Long64_t& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueL(&var), fType(kLong),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const ULong64_t& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueX(&var), fType(kULong),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const Int_t& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueI(&var), fType(kInt),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const UInt_t& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueU(&var), fType(kUInt),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const Short_t& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueS(&var), fType(kShort),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const UShort_t& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueW(&var), fType(kUShort),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const Char_t& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueC(&var), fType(kChar),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const Byte_t& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueB(&var), fType(kByte),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
 
   THaVar( const char* name, const char* descript, const Double_t*& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueDD(&var), fType(kDoubleP),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
 
   THaVar( const char* name, const char* descript, const Float_t*& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueFF(&var), fType(kFloatP),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const Long64_t*& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueLL(&var), fType(kLongP),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const ULong64_t*& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueXX(&var), fType(kULongP),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const Int_t*& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueII(&var), fType(kIntP),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const UInt_t*& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueUU(&var), fType(kUIntP),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const Short_t*& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueSS(&var), fType(kShortP),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const UShort_t*& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueWW(&var), fType(kUShortP),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const Char_t*& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueCC(&var), fType(kCharP),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
   THaVar( const char* name, const char* descript, const Byte_t*& var,
 	  const Int_t* count = 0 ) :
     TNamed(name,descript), fParsedName(name), fValueBB(&var), fType(kByteP),
-    fCount(count), fOffset(-1), fMethod(0), fDim(0) {}
+    fCount(count), fOffset(-1), fMethod(0), fFunc(0), fDim(0) { SetupGetter(); }
 
   THaVar( const char* name, const char* desc, const void* obj,
 	  VarType type, Int_t offset, TMethodCall* method=0,
 	  const Int_t* count=0 );
+  // Method-backed variable accessed via a compiled accessor. If offset is
+  // not -1, obj is a TSeqCollection and func is called for each element.
+  THaVar( const char* name, const char* desc, const void* obj,
+	  VarMethod_t func, Int_t offset=-1 );
 
   virtual const char*  GetName() const { return fParsedName.GetName(); }
 
@@ -124,7 +130,15 @@ public:
   const char*     GetTypeName()  const { return GetTypeName( fType ); }
 
   Double_t        GetValue( Int_t i = 0 )  const { return GetValueAsDouble(i); }
+  // Copy up to n elements, converted to Double_t, to dst. Returns the
+  // number of elements copied, i.e. min(n,GetLen()).
+  Int_t           GetValues( Double_t* dst, Int_t n ) const;
+  // Same, but copy the elements in their native type, i.e. GetTypeSize()
+  // bytes each. Only available if HasNativeValues().
+  Int_t           GetNativeValues( void* dst, Int_t n ) const;
+  Bool_t          HasNativeValues() const { return fRawGetter != 0; }
   const void*     GetValuePointer()        const { return fValueP; }
+  Int_t           GetOffset()              const { return fOffset; }
 
   virtual ULong_t Hash() const { return fParsedName.Hash(); }
   virtual Bool_t  HasSameSize( const THaVar& rhs ) const;
@@ -136,7 +150,7 @@ public:
   Bool_t          IsArray() const
     { return ( IsVarArray() || fParsedName.IsArray() ); }
   Bool_t          IsBasic() const
-    { return ( fOffset == -1 && fMethod == 0 ); }
+    { return ( fOffset == -1 && fMethod == 0 && fFunc == 0 ); }
   Bool_t          IsPointerArray() const
     { return ( IsArray() && fType>=kDouble2P && fType <= kObject2P ); }
   Bool_t          IsVector() const
@@ -145,38 +159,38 @@ public:
 
   // The following are necessary to initialize empty THaVars such as those in arrays,
   // where each element was constructed with the default constructor
-  void SetVar( const Double_t& var ) { fValueD = &var; fType = kDouble; }
-  void SetVar( const Float_t& var )  { fValueF = &var; fType = kFloat; }
-  void SetVar( const Long64_t& var ) { fValueL = &var; fType = kLong; }
-  void SetVar( const ULong64_t& var ){ fValueX = &var; fType = kULong; }
-  void SetVar( const Int_t& var )    { fValueI = &var; fType = kInt; }
-  void SetVar( const UInt_t& var )   { fValueU = &var; fType = kUInt; }
-  void SetVar( const Short_t& var )  { fValueS = &var; fType = kShort; }
-  void SetVar( const UShort_t& var ) { fValueW = &var; fType = kUShort; }
-  void SetVar( const Char_t& var )   { fValueC = &var; fType = kChar; }
-  void SetVar( const Byte_t& var )   { fValueB = &var; fType = kByte; }
-
-  void SetVar( const Double_t*& var ) { fValueDD = &var; fType = kDoubleP; }
-  void SetVar( const Float_t*& var )  { fValueFF = &var; fType = kFloatP; }
-  void SetVar( const Long64_t*& var ) { fValueLL = &var; fType = kLongP; }
-  void SetVar( const ULong64_t*& var ){ fValueXX = &var; fType = kULongP; }
-  void SetVar( const Int_t*& var )    { fValueII = &var; fType = kIntP; }
-  void SetVar( const UInt_t*& var )   { fValueUU = &var; fType = kUIntP; }
-  void SetVar( const Short_t*& var )  { fValueSS = &var; fType = kShortP; }
-  void SetVar( const UShort_t*& var ) { fValueWW = &var; fType = kUShortP; }
-  void SetVar( const Char_t*& var )   { fValueCC = &var; fType = kCharP; }
-  void SetVar( const Byte_t*& var )   { fValueBB = &var; fType = kByteP; }
-
-  void SetVar( const Double_t**& var ) { fValue3D = &var; fType = kDouble2P; }
-  void SetVar( const Float_t**& var )  { fValue3F = &var; fType = kFloat2P; }
-  void SetVar( const Long64_t**& var ) { fValue3L = &var; fType = kLong2P; }
-  void SetVar( const ULong64_t**& var ){ fValue3X = &var; fType = kULong2P; }
-  void SetVar( const Int_t**& var )    { fValue3I = &var; fType = kInt2P; }
-  void SetVar( const UInt_t**& var )   { fValue3U = &var; fType = kUInt2P; }
-  void SetVar( const Short_t**& var )  { fValue3S = &var; fType = kShort2P; }
-  void SetVar( const UShort_t**& var ) { fValue3W = &var; fType = kUShort2P; }
-  void SetVar( const Char_t**& var )   { fValue3C = &var; fType = kChar2P; }
-  void SetVar( const Byte_t**& var )   { fValue3B = &var; fType = kByte2P; }
+  void SetVar( const Double_t& var ) { fValueD = &var; fType = kDouble; SetupGetter(); }
+  void SetVar( const Float_t& var )  { fValueF = &var; fType = kFloat; SetupGetter(); }
+  void SetVar( const Long64_t& var ) { fValueL = &var; fType = kLong; SetupGetter(); }
+  void SetVar( const ULong64_t& var ){ fValueX = &var; fType = kULong; SetupGetter(); }
+  void SetVar( const Int_t& var )    { fValueI = &var; fType = kInt; SetupGetter(); }
+  void SetVar( const UInt_t& var )   { fValueU = &var; fType = kUInt; SetupGetter(); }
+  void SetVar( const Short_t& var )  { fValueS = &var; fType = kShort; SetupGetter(); }
+  void SetVar( const UShort_t& var ) { fValueW = &var; fType = kUShort; SetupGetter(); }
+  void SetVar( const Char_t& var )   { fValueC = &var; fType = kChar; SetupGetter(); }
+  void SetVar( const Byte_t& var )   { fValueB = &var; fType = kByte; SetupGetter(); }
+
+  void SetVar( const Double_t*& var ) { fValueDD = &var; fType = kDoubleP; SetupGetter(); }
+  void SetVar( const Float_t*& var )  { fValueFF = &var; fType = kFloatP; SetupGetter(); }
+  void SetVar( const Long64_t*& var ) { fValueLL = &var; fType = kLongP; SetupGetter(); }
+  void SetVar( const ULong64_t*& var ){ fValueXX = &var; fType = kULongP; SetupGetter(); }
+  void SetVar( const Int_t*& var )    { fValueII = &var; fType = kIntP; SetupGetter(); }
+  void SetVar( const UInt_t*& var )   { fValueUU = &var; fType = kUIntP; SetupGetter(); }
+  void SetVar( const Short_t*& var )  { fValueSS = &var; fType = kShortP; SetupGetter(); }
+  void SetVar( const UShort_t*& var ) { fValueWW = &var; fType = kUShortP; SetupGetter(); }
+  void SetVar( const Char_t*& var )   { fValueCC = &var; fType = kCharP; SetupGetter(); }
+  void SetVar( const Byte_t*& var )   { fValueBB = &var; fType = kByteP; SetupGetter(); }
+
+  void SetVar( const Double_t**& var ) { fValue3D = &var; fType = kDouble2P; SetupGetter(); }
+  void SetVar( const Float_t**& var )  { fValue3F = &var; fType = kFloat2P; SetupGetter(); }
+  void SetVar( const Long64_t**& var ) { fValue3L = &var; fType = kLong2P; SetupGetter(); }
+  void SetVar( const ULong64_t**& var ){ fValue3X = &var; fType = kULong2P; SetupGetter(); }
+  void SetVar( const Int_t**& var )    { fValue3I = &var; fType = kInt2P; SetupGetter(); }
+  void SetVar( const UInt_t**& var )   { fValue3U = &var; fType = kUInt2P; SetupGetter(); }
+  void SetVar( const Short_t**& var )  { fValue3S = &var; fType = kShort2P; SetupGetter(); }
+  void SetVar( const UShort_t**& var ) { fValue3W = &var; fType = kUShort2P; SetupGetter(); }
+  void SetVar( const Char_t**& var )   { fValue3C = &var; fType = kChar2P; SetupGetter(); }
+  void SetVar( const Byte_t**& var )   { fValue3B = &var; fType = kByte2P; SetupGetter(); }
 
   virtual void    SetName( const char* );
   virtual void    SetNameTitle( const char* name, const char* descript );
@@ -186,10 +200,25 @@ public:
   static const char* GetTypeName( VarType type );
   static size_t      GetTypeSize( VarType type );
 
+  // Type-specialized accessors, selected once by SetupGetter
+  typedef Double_t (*Getter_t)( const THaVar* var, Int_t i );
+  typedef void (*BulkGetter_t)( const THaVar* var, Double_t* dst, Int_t n );
+  typedef void (*RawGetter_t)( const THaVar* var, void* dst, Int_t n );
+
 protected:
   Double_t            GetValueAsDouble( Int_t i=0 ) const;
   Double_t            GetValueFromObject( Int_t i=0 ) const;
   Int_t               GetObjArrayLen() const;
+  void                SetupGetter();
+  static Double_t     GetFromObject( const THaVar* var, Int_t i );
+  static void         GetManyFromObject( const THaVar* var, Double_t* dst,
+					 Int_t n );
+  static Double_t     GetFromFunc( const THaVar* var, Int_t i );
+  static void         GetManyFromFunc( const THaVar* var, Double_t* dst,
+				       Int_t n );
+  static Double_t     GetFromFuncArray( const THaVar* var, Int_t i );
+  static void         GetManyFromFuncArray( const THaVar* var, Double_t* dst,
+					    Int_t n );
 
   THaArrayString      fParsedName; //Variable name and array dimension(s), if any
   union {
@@ -232,10 +261,31 @@ protected:
 
   Int_t               fOffset;   //Offset of data w.r.t. object pointer
   TMethodCall*        fMethod;   //Member function to access data in object
+  VarMethod_t         fFunc;     //! Compiled accessor, replaces fMethod
   mutable Int_t       fDim;      //Current size of object array
+  Getter_t            fGetter;   //! Accessor for fType
+  BulkGetter_t        fBulkGetter; //! Converting copy for fType
+  RawGetter_t         fRawGetter; //! Copy in native type, if supported
+  Bool_t              fIsObjArray; //! fObject is a TObjArray/TClonesArray
 
   ClassDef(THaVar,0)   //Global symbolic variable
 };
 
+//_____________________________________________________________________________
+inline Double_t THaVar::GetValueAsDouble( Int_t i ) const
+{
+  // Retrieve current value of this global variable.
+  // If the variable is an array/vector, return its i-th element.
+
+#ifdef WITH_DEBUG
+  if( i<0 || i>=GetLen() ) {
+    Warning("GetValue()", "Whoa! Index out of range, variable %s, index %d",
+	    GetName(), i );
+    return kInvalid;
+  }
+#endif
+  return fGetter( this, i );
+}
+
 #endif
 
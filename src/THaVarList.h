@@ -12,6 +12,10 @@
 #include "THaVar.h"
 #include "VarDef.h"
 #include <vector>
+#ifndef __CINT__
+#include <map>
+#include <string>
+#endif
 
 class THaVarList : public THashList {
   
@@ -175,7 +179,8 @@ public:
   virtual THaVar*  DefineByRTTI( const TString& name, const TString& desc,
 				 const TString& def, const void* const obj,
 				 TClass* const cl,
-				 const char* errloc = "DefineByRTTI" );
+				 const char* errloc = "DefineByRTTI",
+				 VarMethod_t func = 0 );
   virtual Int_t    DefineVariables( const VarDef* list, 
 				    const char* prefix="",
 				    const char* caller="" );
@@ -185,14 +190,54 @@ public:
 				    const char* caller="",
 				    const char* var_prefix="" );
   virtual THaVar*  Find( const char* name ) const;
+
+  // Interned variable handles. A handle is a stable index for a variable
+  // name, valid for the lifetime of the list, whether or not the variable
+  // is currently defined. The generation of a handle changes whenever the
+  // variable with that name is (re)defined or removed.
+          Int_t    GetHandle( const char* name ) const;
+          THaVar*  GetVar( Int_t handle ) const;
+          UInt_t   GetGeneration( Int_t handle ) const;
+          UInt_t   GetGeneration() const { return fGeneration; }
+
   virtual void     PrintFull(Option_t *opt="") const;
   virtual Int_t    RemoveName( const char* name );
   virtual Int_t    RemoveRegexp( const char* expr, Bool_t wildcard = kTRUE );
 
 protected:
+          void     UpdateHandle( THaVar* var, Bool_t defined );
+
+#ifndef __CINT__
+  struct VarSlot_t {
+    THaVar*  var;   // Currently defined variable, or 0
+    UInt_t   gen;   // Generation count of this name
+    VarSlot_t() : var(0), gen(0) {}
+  };
+  mutable std::vector<VarSlot_t>       fSlots;   //! Variables by handle
+  mutable std::map<std::string,Int_t>  fHandles; //! Handles by name
+#endif
+  UInt_t   fGeneration;  //! Count of all (re)definitions and removals
 
   ClassDef(THaVarList,2)   //List of analyzer global variables
 };
 
+#ifndef __CINT__
+//_____________________________________________________________________________
+inline THaVar* THaVarList::GetVar( Int_t handle ) const
+{
+  if( handle < 0 || handle >= static_cast<Int_t>(fSlots.size()) )
+    return 0;
+  return fSlots[handle].var;
+}
+
+//_____________________________________________________________________________
+inline UInt_t THaVarList::GetGeneration( Int_t handle ) const
+{
+  if( handle < 0 || handle >= static_cast<Int_t>(fSlots.size()) )
+    return 0;
+  return fSlots[handle].gen;
+}
+#endif
+
 #endif
 
@@ -24,7 +24,8 @@ class THaVform : public THaFormula {
 
 public:
 
-  THaVform() : THaFormula(), fType(kUnknown), fVarPtr(0), fOdata(0) {}
+  THaVform() : THaFormula(), fType(kUnknown), fVarPtr(0), fOdata(0),
+    fShareForms(kFALSE) {}
   THaVform( const char *type, const char* name, const char* formula,
       const THaVarList* vlst=gHaVars, const THaCutList* clst=gHaCuts );
   virtual  ~THaVform();
@@ -33,6 +34,8 @@ public:
 
 // Over-rides base class DefinedGlobalVariables
   Int_t DefinedGlobalVariable( TString& variable );
+// Resets the variable bookkeeping before parsing
+  virtual Int_t Compile( const char* expression="" );
 // Self-explanatory printouts
   void  ShortPrint() const;
   void  LongPrint() const;
@@ -62,6 +65,9 @@ public:
   Int_t GetSize() const { return fObjSize; };
 // Get names of variable that are used by this formula.
   std::vector<std::string> GetVars() const;
+// Let the formulas/cuts that evaluate this object take part in
+// THaFormula::BuildShared. This object's own expression does not.
+  void SetShareable( Bool_t b = kTRUE );
 
 protected:
 
@@ -95,6 +101,7 @@ protected:
   THaVar   *fVarPtr;
   THaOdata *fOdata;
   Int_t fPrefix;
+  Bool_t fShareForms;  // fFormula/fCut are shareable
 
 private:
 
@@ -16,9 +16,23 @@ class THaVar;
 class TH1F;
 class TH2F;
 class THaCut;
+class TMutex;
+class THaVhistSlot;
 
 using std::string;
 
+// Values to be filled into a THaVhist in one event, taken by
+// THaVhist::Evaluate() for THaVhist::Fill()
+class THaVhistEvent {
+public:
+  THaVhistEvent() : fSize(0) {}
+  void Clear() { fSize = 0; fK.clear(); fX.clear(); fY.clear(); }
+  Int_t GetN() const { return fK.size(); }
+  Int_t                 fSize;  // Vector size of the THaVhist in this event
+  std::vector<Int_t>    fK;     // Index of the histogram to fill
+  std::vector<Double_t> fX, fY; // Values to fill (fY empty if 1D)
+};
+
 class THaVhist {
   
 public:
@@ -36,6 +50,7 @@ public:
    const string& GetVarX() const { return fVarX; };
    const string& GetVarY() const { return fVarY; };
    const string& GetCutStr() const  { return fScut; };
+   const string& GetName() const { return fName; };
    Int_t CheckCut(Int_t index=0);
    Bool_t HasCut() const { return !fScut.empty(); };
    Bool_t IsValid() const { return fProc; };
@@ -43,10 +58,30 @@ public:
    Int_t Init();
 // Must ReAttach() if pointers to global variables reset
    void ReAttach();
-// Must Process() each event. 
-   Int_t Process();
+// Must Process() each event, i.e. Evaluate() and Fill() the given slot.
+   Int_t Process(UInt_t slot=0);
+// Evaluate the formulas and cuts for the current event and take the
+// values to fill into 'ev'.  Not thread-safe.
+   Int_t Evaluate(THaVhistEvent& ev);
+// Fill the values in 'ev' into the histograms of the given slot.  With
+// several slots (see SetNSlots), calls for different slots may run
+// concurrently, also with Evaluate().
+   Int_t Fill(UInt_t slot, const THaVhistEvent& ev);
 // Must End() to write histogram to output at end of analysis.
+// Merges the slots, if any, in slot order.
    Int_t End();
+// Histogram i (merged with the slots only after End())
+   TH1*  GetHist(Int_t i=0) const
+     { return (i >= 0 && i < static_cast<Int_t>(fH1.size())) ? fH1[i] : 0; };
+// Number of independently filled slots, e.g. event sources.  Each slot
+// fills private replicas of the histograms.  In shared-bin mode, 2D
+// histograms are instead filled through one array of atomic bin counters
+// shared by all slots, which bounds the memory use for large histograms.
+// Both take effect at the next Init().
+   void  SetNSlots(UInt_t nslots) { fNSlots = nslots; };
+   UInt_t GetNSlots() const { return fNSlots; };
+   void  SetSharedBins(Bool_t shared=kTRUE) { fSharedBins = shared; };
+   Bool_t IsSharedBins() const { return fSharedBins; };
 // Self-explanatory printouts.
    void  Print() const;
    void  ErrPrint() const;
@@ -64,6 +99,17 @@ protected:
    Int_t FindVarSize();
    Bool_t FindEye(const string& var);
    Int_t GetCut(Int_t index=0); 
+   void  SetupSlots();
+   void  SyncSlot(THaVhistSlot* slot, Int_t size);
+   void  GrowShared();
+   void  MergeSlots();
+   void  ClearSlots();
+   TH1*  MakeReplica(const TH1* h);
+#ifndef __CINT__
+   template< typename Fill_t > void FillAll(Fill_t& fill, Int_t size);
+   template< typename Fill_t > void FillEvent(Fill_t& fill,
+					     const THaVhistEvent& ev);
+#endif
 
    enum FEr { kOK = 0, kNoBinX, kIllFox, kIllFoy, kIllCut,
               kNoX, kAxiSiz, kCutSix, kCutSiy,
@@ -81,6 +127,16 @@ protected:
    THaVform *fFormX, *fFormY, *fCut;
    Bool_t fMyFormX, fMyFormY, fMyCut;
 
+   Int_t  fEvSize;                  // Largest vector size seen by Evaluate()
+   UInt_t fNSlots;                  // Number of fill slots (<=1: fill fH1)
+   UInt_t fNSlotsUsed;              // Number of slots set up at Init()
+   Bool_t fSharedBins;              // Shared-bin mode requested
+   Bool_t fShared;                  // Shared-bin mode in use
+   THaVhistSlot** fSlots;           //! [fNSlotsUsed] Per-slot fill state
+   std::vector<Long64_t*> fBins;    //! Shared bin counters, one per histogram
+   TMutex* fLock;                   //! Protects booking and slot growth
+   THaVhistEvent fEvent;            //! Values of the current event (Process)
+
 private:
 
   THaVhist(const THaVhist& vhist);
@@ -23,12 +23,32 @@ struct VarDef {
   const Int_t*     count;    // Optional: Actual size of variable size array
 };
 
+// Compiled accessor for a method-backed global variable. Takes a pointer
+// to the object and returns the method's result.
+typedef Double_t (*VarMethod_t)( const void* obj );
+
 struct RVarDef {
   const char*      name;     // Variable name
   const char*      desc;     // Variable description
   const char*      def;      // Definition of data (data member or method name)
+  VarMethod_t      func;     // (opt) Compiled accessor for method definitions
 };
 
+#ifndef __CINT__
+// Generates a VarMethod_t for a const member function C::M() returning R.
+// Use it as the 'func' field of an RVarDef whose definition is a method
+// call, so that the variable can be evaluated without the interpreter:
+//
+//   { "tr.px", "Lab momentum x (GeV)", "fTracks.THaTrack.GetLabPx()",
+//     VarMethod<THaTrack,Double_t,&THaTrack::GetLabPx> },
+//
+template< class C, typename R, R (C::*M)() const >
+Double_t VarMethod( const void* obj )
+{
+  return static_cast<Double_t>( (static_cast<const C*>(obj)->*M)() );
+}
+#endif
+
 struct DBRequest {
   const char*      name;     // Key name
   void*            var;      // Pointer to data (default to Double*)